@@ -123,13 +123,16 @@ struct CoDiPackForwardTool final : public medi::ADToolBase<CoDiPackForwardTool<C
     }
   }
 
+  // Forward types have no index; the gradient data may be a vector
+  // (RealForwardVec) and is transferred with the value
   static inline int getIndex(const Type& value) {
-    return value.getGradientData();
+    MEDI_UNUSED(value);
+    return 0;
   }
 
   static inline void clearIndex(Type& value) {
     value.~Type();
-    value.getGradientData() = 0;
+    value.getGradientData() = typename CoDiType::GradientData();
   }
 
   static inline void createIndex(Type& value, int& index) {
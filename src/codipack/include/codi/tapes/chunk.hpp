@@ -37,6 +37,7 @@
 
 #include "../configure.h"
 #include "../tools/io.hpp"
+#include "chunkStorage.hpp"
 #include "../typeFunctions.hpp"
 
 /**
@@ -55,14 +56,19 @@ namespace codi {
 
     size_t size; /**< Size of the allocated data */
     size_t usedSize; /**< Number of used items in the data array */
+    ChunkStorage* storage; /**< Storage of the data, NULL for the heap */
 
     /**
      * @brief Create a chunk with the given size.
+     *
+     * The data is placed in the global chunk storage.
+     *
      * @param size  The size of the data in the chunk.
      */
     explicit ChunkInterface(const size_t& size) :
       size(size),
-      usedSize(0) {}
+      usedSize(0),
+      storage(ChunkStorage::getGlobal()) {}
 
     /**
      * @brief Destructor for the the chunk interface
@@ -105,6 +111,72 @@ namespace codi {
     void swapBase(ChunkInterface& other) {
       std::swap(size, other.size);
       std::swap(usedSize, other.usedSize);
+      std::swap(storage, other.storage);
+    }
+
+    /**
+     * @brief Allocate one data array of the chunk in the storage.
+     *
+     * @tparam Data  The type of the stored data.
+     * @return The data array with size items.
+     */
+    template<typename Data>
+    Data* allocateArray() {
+      if(NULL == storage) {
+        return new Data[size];
+      }
+
+      Data* data = static_cast<Data*>(storage->allocate(size * sizeof(Data)));
+      for(size_t i = 0; i < size; ++i) {
+        new (data + i) Data;
+      }
+
+      return data;
+    }
+
+    /**
+     * @brief Delete one data array of the chunk.
+     *
+     * @param data  The data array created by allocateArray.
+     * @tparam Data  The type of the stored data.
+     */
+    template<typename Data>
+    void deleteArray(Data* data) {
+      if(NULL == storage) {
+        delete [] data;
+      } else {
+        for(size_t i = 0; i < size; ++i) {
+          data[i].~Data();
+        }
+
+        storage->deallocate(data, size * sizeof(Data));
+      }
+    }
+
+    /**
+     * @brief Give the store hint for the used part of one data array to the storage.
+     *
+     * @param data  The data array.
+     * @tparam Data  The type of the stored data.
+     */
+    template<typename Data>
+    CODI_INLINE void storeArray(Data* data) {
+      if(NULL != storage && NULL != data) {
+        storage->store(data, usedSize * sizeof(Data));
+      }
+    }
+
+    /**
+     * @brief Give the prefetch hint for the used part of one data array to the storage.
+     *
+     * @param data  The data array.
+     * @tparam Data  The type of the stored data.
+     */
+    template<typename Data>
+    CODI_INLINE void prefetchArray(Data* data) {
+      if(NULL != storage && NULL != data) {
+        storage->prefetch(data, usedSize * sizeof(Data));
+      }
     }
 
     /**
@@ -161,6 +233,14 @@ namespace codi {
      * evaluation process.
      */
     CODI_INLINE void load() {}
+
+    /**
+     * @brief Announce that the data of the chunk is needed soon.
+     *
+     * This method is called by the evaluation process for the chunk
+     * that is evaluated next.
+     */
+    CODI_INLINE void prefetch() {}
   };
 
   /**
@@ -225,7 +305,7 @@ namespace codi {
      */
     void allocateData() {
       if(NULL == data) {
-        data = new Data[size];
+        data = allocateArray<Data>();
       }
     }
 
@@ -234,11 +314,25 @@ namespace codi {
      */
     void deleteData() {
       if(NULL != data) {
-        delete [] data;
+        deleteArray(data);
         data = NULL;
       }
     }
 
+    /**
+     * @brief The data of the chunk is complete, give the hint to the storage.
+     */
+    CODI_INLINE void store() {
+      storeArray(data);
+    }
+
+    /**
+     * @brief The data of the chunk is needed soon, give the hint to the storage.
+     */
+    CODI_INLINE void prefetch() {
+      prefetchArray(data);
+    }
+
     /**
      * @brief Swap the data of this chunk and the other chunk.
      *
@@ -347,11 +441,11 @@ namespace codi {
      */
     void allocateData() {
       if(NULL == data1) {
-        data1 = new Data1[size];
+        data1 = allocateArray<Data1>();
       }
 
       if(NULL == data2) {
-        data2 = new Data2[size];
+        data2 = allocateArray<Data2>();
       }
     }
 
@@ -360,16 +454,32 @@ namespace codi {
      */
     void deleteData() {
       if(NULL != data1) {
-        delete [] data1;
+        deleteArray(data1);
         data1 = NULL;
       }
 
       if(NULL != data2) {
-        delete [] data2;
+        deleteArray(data2);
         data2 = NULL;
       }
     }
 
+    /**
+     * @brief The data of the chunk is complete, give the hint to the storage.
+     */
+    CODI_INLINE void store() {
+      storeArray(data1);
+      storeArray(data2);
+    }
+
+    /**
+     * @brief The data of the chunk is needed soon, give the hint to the storage.
+     */
+    CODI_INLINE void prefetch() {
+      prefetchArray(data1);
+      prefetchArray(data2);
+    }
+
     /**
      * @brief Swap the data of this chunk and the other chunk.
      *
@@ -491,15 +601,15 @@ namespace codi {
      */
     void allocateData() {
       if(NULL == data1) {
-        data1 = new Data1[size];
+        data1 = allocateArray<Data1>();
       }
 
       if(NULL == data2) {
-        data2 = new Data2[size];
+        data2 = allocateArray<Data2>();
       }
 
       if(NULL == data3) {
-        data3 = new Data3[size];
+        data3 = allocateArray<Data3>();
       }
     }
 
@@ -508,21 +618,39 @@ namespace codi {
      */
     void deleteData() {
       if(NULL != data1) {
-        delete [] data1;
+        deleteArray(data1);
         data1 = NULL;
       }
 
       if(NULL != data2) {
-        delete [] data2;
+        deleteArray(data2);
         data2 = NULL;
       }
 
       if(NULL != data3) {
-        delete [] data3;
+        deleteArray(data3);
         data3 = NULL;
       }
     }
 
+    /**
+     * @brief The data of the chunk is complete, give the hint to the storage.
+     */
+    CODI_INLINE void store() {
+      storeArray(data1);
+      storeArray(data2);
+      storeArray(data3);
+    }
+
+    /**
+     * @brief The data of the chunk is needed soon, give the hint to the storage.
+     */
+    CODI_INLINE void prefetch() {
+      prefetchArray(data1);
+      prefetchArray(data2);
+      prefetchArray(data3);
+    }
+
     /**
      * @brief Swap the data of this chunk and the other chunk.
      *
@@ -654,19 +782,19 @@ namespace codi {
      */
     void allocateData() {
       if(NULL == data1) {
-        data1 = new Data1[size];
+        data1 = allocateArray<Data1>();
       }
 
       if(NULL == data2) {
-        data2 = new Data2[size];
+        data2 = allocateArray<Data2>();
       }
 
       if(NULL == data3) {
-        data3 = new Data3[size];
+        data3 = allocateArray<Data3>();
       }
 
       if(NULL == data4) {
-        data4 = new Data4[size];
+        data4 = allocateArray<Data4>();
       }
     }
 
@@ -675,26 +803,46 @@ namespace codi {
      */
     void deleteData() {
       if(NULL != data1) {
-        delete [] data1;
+        deleteArray(data1);
         data1 = NULL;
       }
 
       if(NULL != data2) {
-        delete [] data2;
+        deleteArray(data2);
         data2 = NULL;
       }
 
       if(NULL != data3) {
-        delete [] data3;
+        deleteArray(data3);
         data3 = NULL;
       }
 
       if(NULL != data4) {
-        delete [] data4;
+        deleteArray(data4);
         data4 = NULL;
       }
     }
 
+    /**
+     * @brief The data of the chunk is complete, give the hint to the storage.
+     */
+    CODI_INLINE void store() {
+      storeArray(data1);
+      storeArray(data2);
+      storeArray(data3);
+      storeArray(data4);
+    }
+
+    /**
+     * @brief The data of the chunk is needed soon, give the hint to the storage.
+     */
+    CODI_INLINE void prefetch() {
+      prefetchArray(data1);
+      prefetchArray(data2);
+      prefetchArray(data3);
+      prefetchArray(data4);
+    }
+
     /**
      * @brief Swap the data of this chunk and the other chunk.
      *
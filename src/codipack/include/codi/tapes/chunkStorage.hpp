@@ -0,0 +1,133 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2020 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Homepage: http://www.scicomp.uni-kl.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Tim Albring (SciComp, TU Kaiserslautern)
+ *
+ * This file is part of CoDiPack (http://www.scicomp.uni-kl.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Authors:
+ *  - SciComp, TU Kaiserslautern:
+ *     Max Sagebaum
+ *     Tim Albring
+ *     Johannes Blühdorn
+ */
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+#include "../configure.h"
+
+/**
+ * @brief Global namespace for CoDiPack - Code Differentiation Package
+ */
+namespace codi {
+
+  /**
+   * @brief Interface for the memory that backs the data arrays of the chunks.
+   *
+   * By default the chunks allocate their data on the heap. A storage that is set with
+   * ChunkStorage::setGlobal is used for all chunks that are created afterwards, e.g. to
+   * place the tape data in memory mapped files. Each chunk remembers the storage it was
+   * allocated with, so the storage has to outlive all of its chunks.
+   *
+   * Besides the allocation the storage receives two hints from the chunk vectors:
+   *  - store:    The data of a chunk is complete and is not accessed in the near future.
+   *  - prefetch: The data of a chunk is accessed in the near future.
+   * The hints do not change the data, they only allow the storage to move the data
+   * between the memory and a backing store.
+   */
+  struct ChunkStorage {
+
+    /**
+     * @brief Destructor for the chunk storage.
+     */
+    virtual ~ChunkStorage() {}
+
+    /**
+     * @brief Allocate memory for the data of a chunk.
+     *
+     * @param bytes  The number of bytes.
+     * @return Pointer to the memory, aligned for all data types of the chunks.
+     */
+    virtual void* allocate(size_t bytes) = 0;
+
+    /**
+     * @brief Release memory that was acquired by allocate.
+     *
+     * @param  data  The pointer returned by allocate.
+     * @param bytes  The number of bytes given to allocate.
+     */
+    virtual void deallocate(void* data, size_t bytes) = 0;
+
+    /**
+     * @brief Hint that the data of a chunk is complete.
+     *
+     * @param  data  The pointer returned by allocate.
+     * @param bytes  The number of used bytes from the start of the data.
+     */
+    virtual void store(void* data, size_t bytes) {
+      CODI_UNUSED(data);
+      CODI_UNUSED(bytes);
+    }
+
+    /**
+     * @brief Hint that the data of a chunk is read in the near future.
+     *
+     * @param  data  The pointer returned by allocate.
+     * @param bytes  The number of used bytes from the start of the data.
+     */
+    virtual void prefetch(void* data, size_t bytes) {
+      CODI_UNUSED(data);
+      CODI_UNUSED(bytes);
+    }
+
+    /**
+     * @brief The storage used for new chunks.
+     * @return The storage, NULL if the chunks use the heap.
+     */
+    static ChunkStorage* getGlobal() {
+      return globalStorage();
+    }
+
+    /**
+     * @brief Set the storage for all chunks that are created afterwards.
+     *
+     * Existing chunks keep their storage.
+     *
+     * @param storage  The new storage, NULL for the heap.
+     */
+    static void setGlobal(ChunkStorage* storage) {
+      globalStorage() = storage;
+    }
+
+    private:
+
+      /**
+       * @brief The global storage instance.
+       * @return Reference to the global storage pointer.
+       */
+      static ChunkStorage*& globalStorage() {
+        static ChunkStorage* storage = NULL;
+        return storage;
+      }
+  };
+}
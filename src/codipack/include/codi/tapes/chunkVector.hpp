@@ -660,6 +660,9 @@ namespace codi {
       NestedPosition curInnerPos = start.inner;
       for(size_t curChunk = start.chunk; curChunk > end.chunk; --curChunk) {
 
+        // Read ahead: the chunk before is evaluated next
+        chunks[curChunk - 1]->prefetch();
+
         pHandle.setPointers(0, chunks[curChunk]);
 
         NestedPosition endInnerPos = positions[curChunk];
@@ -667,6 +670,9 @@ namespace codi {
 
         codiAssert(dataPos == 0); // after a full chunk is evaluated, the data position needs to be zero
 
+        // The chunk is not needed for the rest of this evaluation
+        chunks[curChunk]->store();
+
         curInnerPos = endInnerPos;
 
         dataPos = chunks[curChunk - 1]->getUsedSize();
@@ -716,6 +722,9 @@ namespace codi {
       NestedPosition curInnerPos = start.inner;
       for(size_t curChunk = start.chunk; curChunk < end.chunk; ++curChunk) {
 
+        // Read ahead: the chunk after is evaluated next
+        chunks[curChunk + 1]->prefetch();
+
         pHandle.setPointers(0, chunks[curChunk]);
 
         NestedPosition endInnerPos = positions[curChunk + 1];
@@ -724,6 +733,9 @@ namespace codi {
         // After a full chunk is evaluated, the data position needs to be at the end of the chunk
         codiAssert(dataPos == chunks[curChunk]->getUsedSize());
 
+        // The chunk is not needed for the rest of this evaluation
+        chunks[curChunk]->store();
+
         curInnerPos = endInnerPos;
 
         dataPos = 0;
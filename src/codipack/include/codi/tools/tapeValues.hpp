@@ -131,6 +131,32 @@ namespace codi {
         return doubleData[1];
       }
 
+      /**
+       * @brief Get the value of a named item in a section.
+       *
+       * @param[in] section  The name of the section.
+       * @param[in]    name  The name of the data item.
+       *
+       * @return The value of the item, zero if the item is not present.
+       */
+      double getData(const std::string& section, const std::string& name) const {
+        for(const ValueSection& curSection : sections) {
+          if(curSection.name == section) {
+            for(const Entry& data : curSection.data) {
+              if(std::get<0>(data) == name) {
+                if(EntryType::Int == std::get<1>(data)) {
+                  return (double)intData[std::get<2>(data)];
+                } else {
+                  return doubleData[std::get<2>(data)];
+                }
+              }
+            }
+          }
+        }
+
+        return 0.0;
+      }
+
       /**
        * @brief Start a new section.
        *
@@ -0,0 +1,3 @@
+#!/usr/bin/env bash
+
+rm -rf runs && rm -f benchmarkResults.json || exit 1
@@ -0,0 +1,10 @@
+#!/usr/bin/env bash
+
+if [ -z "$WM_PROJECT" ]; then
+  echo "OpenFOAM environment not found, forgot to source the OpenFOAM bashrc?"
+  exit 1
+fi
+
+# Default: full ladder, all models, passive/forward/reverse builds, serial.
+# Pass options through, e.g. ./Allrun.sh --sizes 22 47 --np 4
+python runBenchmarks.py "$@" || exit 1
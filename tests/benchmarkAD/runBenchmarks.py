@@ -0,0 +1,289 @@
+"""
+AD performance benchmarks for simpleFoam
+
+Runs a ladder of blockMesh cubes (10k to 5M cells) for laminar,
+SpalartAllmaras and kOmegaSST flow through a duct. Each case runs with the
+passive, forward and reverse builds, and the script reports wall time, peak
+RSS and tape memory together with the tangent/primal and adjoint/primal cost
+ratios.
+
+    passive : simpleFoam from the reverse build, tape inactive (primal)
+    forward : simpleFoam from the forward build (tangent)
+    reverse : DASimpleFoamReverseAD, records and evaluates the tape (adjoint)
+
+There is no plain double build of this tree, so the primal reference is the
+reverse build run with the tape inactive, i.e. the cost of the active type
+without recording.
+
+Usage:
+    python runBenchmarks.py [--sizes 22 47 100 171]
+                            [--models laminar SpalartAllmaras kOmegaSST]
+                            [--modes passive forward reverse]
+                            [--np 1] [--iterations 20]
+                            [--output benchmarkResults.json]
+
+The results are written as JSON and a summary table is printed. Runs that
+fail (e.g. out of memory) are recorded with their status and excluded from
+the ratios.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import re
+import shutil
+import socket
+import subprocess
+import sys
+import time
+
+# Default mesh ladder: n^3 cells, ~10k, 100k, 1M and 5M
+defaultSizes = [22, 47, 100, 171]
+
+models = {
+    "laminar": {
+        "simulationType": "laminar",
+        "RASModel": "SpalartAllmaras",
+        "nu": 1e-3,
+    },
+    "SpalartAllmaras": {
+        "simulationType": "RAS",
+        "RASModel": "SpalartAllmaras",
+        "nu": 1e-5,
+    },
+    "kOmegaSST": {
+        "simulationType": "RAS",
+        "RASModel": "kOmegaSST",
+        "nu": 1e-5,
+    },
+}
+
+# Build suffix (WM_CODI_AD_SUFFIX), application and options for each mode
+modes = {
+    "passive": ("ADr", "simpleFoam", []),
+    "forward": ("ADf", "simpleFoam", []),
+    "reverse": ("ADr", "DASimpleFoamReverseAD", ["-patchNames", "(walls)"]),
+}
+
+# Runs a command and prints the peak RSS (kB) of its largest process
+rusageWrapper = (
+    "import resource, subprocess, sys\n"
+    "status = subprocess.call(sys.argv[1:])\n"
+    "sys.stderr.write('peakRSS %d\\n'"
+    " % resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss)\n"
+    "sys.exit(status)\n"
+)
+
+tapeMemoryRe = re.compile(r"Memory used by the tape:\s*([0-9.eE+-]+)\s*MB")
+
+
+def binDir(suffix):
+    projectDir = os.environ["WM_PROJECT_DIR"]
+    libOptions = os.environ.get("WM_LIB_OPTIONS", os.environ["WM_OPTIONS"])
+    return os.path.join(projectDir, "platforms", libOptions + suffix, "bin")
+
+
+def run(cmd, caseDir, logName):
+    """Run cmd in caseDir. Returns (status, wallTime [s], peakRSS [kB])"""
+    logFile = os.path.join(caseDir, logName)
+    with open(logFile, "w") as log:
+        start = time.time()
+        proc = subprocess.Popen(
+            [sys.executable, "-c", rusageWrapper] + cmd,
+            cwd=caseDir,
+            stdout=log,
+            stderr=subprocess.PIPE,
+            universal_newlines=True,
+        )
+        _, err = proc.communicate()
+        wallTime = time.time() - start
+
+    peakRSS = None
+    for line in err.splitlines():
+        if line.startswith("peakRSS "):
+            peakRSS = int(line.split()[1])
+        else:
+            sys.stderr.write(line + "\n")
+
+    return proc.returncode, wallTime, peakRSS
+
+
+def writeParameters(caseDir, n, model, args):
+    params = dict(models[model])
+    params.update({"n": n, "endTime": args.iterations, "nProcs": args.np})
+
+    with open(os.path.join(caseDir, "system", "benchmarkParameters"), "a") as f:
+        f.write("\n// Set by runBenchmarks.py\n")
+        for key in sorted(params):
+            f.write("%-16s%s;\n" % (key, params[key]))
+
+
+def resetFields(caseDir, parallel, utilBin):
+    """Remove results of previous runs and restore the initial fields"""
+    for entry in os.listdir(caseDir):
+        path = os.path.join(caseDir, entry)
+        if entry.startswith("processor") or re.match(r"^[0-9.eE+-]+$", entry):
+            shutil.rmtree(path)
+    shutil.copytree(os.path.join(caseDir, "0.orig"), os.path.join(caseDir, "0"))
+
+    if parallel:
+        status, _, _ = run(
+            [os.path.join(utilBin, "decomposePar"), "-force"],
+            caseDir,
+            "log.decomposePar",
+        )
+        if status != 0:
+            raise RuntimeError("decomposePar failed in " + caseDir)
+
+
+def setupCase(n, model, args):
+    caseName = "%s_%d" % (model, n)
+    caseDir = os.path.join(args.runDir, caseName)
+    if os.path.isdir(caseDir):
+        shutil.rmtree(caseDir)
+    shutil.copytree(args.template, caseDir)
+    writeParameters(caseDir, n, model, args)
+
+    status, _, _ = run(
+        [os.path.join(binDir("ADr"), "blockMesh")], caseDir, "log.blockMesh"
+    )
+    if status != 0:
+        raise RuntimeError("blockMesh failed in " + caseDir)
+
+    return caseName, caseDir
+
+
+def runMode(caseDir, mode, args):
+    suffix, app, options = modes[mode]
+    parallel = args.np > 1
+
+    resetFields(caseDir, parallel, binDir("ADr"))
+
+    cmd = [os.path.join(binDir(suffix), app)] + options
+    if parallel:
+        cmd = ["mpirun", "-np", str(args.np)] + cmd + ["-parallel"]
+
+    logName = "log." + mode
+    status, wallTime, peakRSS = run(cmd, caseDir, logName)
+
+    tapeMB = None
+    with open(os.path.join(caseDir, logName)) as log:
+        for match in tapeMemoryRe.finditer(log.read()):
+            tapeMB = float(match.group(1))
+
+    return {
+        "mode": mode,
+        "status": "ok" if status == 0 else "failed (%d)" % status,
+        "wallTime": wallTime,
+        "peakRSS": peakRSS,
+        "tapeMB": tapeMB,
+    }
+
+
+def ratios(runs):
+    """Cost ratios tangent/primal and adjoint/primal per case"""
+    byCase = {}
+    for r in runs:
+        if r["status"] == "ok":
+            byCase.setdefault(r["case"], {})[r["mode"]] = r
+
+    result = {}
+    for caseName, byMode in sorted(byCase.items()):
+        primal = byMode.get("passive")
+        if primal is None or primal["wallTime"] <= 0:
+            continue
+        entry = {}
+        if "forward" in byMode:
+            entry["tangent/primal"] = \
+                byMode["forward"]["wallTime"]/primal["wallTime"]
+        if "reverse" in byMode:
+            entry["adjoint/primal"] = \
+                byMode["reverse"]["wallTime"]/primal["wallTime"]
+        result[caseName] = entry
+
+    return result
+
+
+def printSummary(runs, caseRatios):
+    fmt = "%-22s %9s %-8s %-12s %10s %12s %10s"
+    print(fmt % ("case", "cells", "mode", "status", "wall [s]",
+                 "peakRSS [MB]", "tape [MB]"))
+    for r in runs:
+        print(fmt % (
+            r["case"], r["nCells"], r["mode"], r["status"],
+            "%.2f" % r["wallTime"],
+            "-" if r["peakRSS"] is None else "%.1f" % (r["peakRSS"]/1024.0),
+            "-" if r["tapeMB"] is None else "%.1f" % r["tapeMB"],
+        ))
+
+    print("")
+    for caseName, entry in sorted(caseRatios.items()):
+        print("%-22s %s" % (caseName, "  ".join(
+            "%s = %.2f" % item for item in sorted(entry.items()))))
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+
+    parser = argparse.ArgumentParser(description="AD benchmarks for simpleFoam")
+    parser.add_argument("--sizes", type=int, nargs="+", default=defaultSizes,
+                        help="cells per direction of the cube")
+    parser.add_argument("--models", nargs="+", default=sorted(models),
+                        choices=sorted(models))
+    parser.add_argument("--modes", nargs="+",
+                        default=["passive", "forward", "reverse"],
+                        choices=sorted(modes))
+    parser.add_argument("--np", type=int, default=1,
+                        help="number of MPI ranks")
+    parser.add_argument("--iterations", type=int, default=20,
+                        help="number of SIMPLE iterations")
+    parser.add_argument("--output", default="benchmarkResults.json")
+    parser.add_argument("--template", default=os.path.join(here, "case"))
+    parser.add_argument("--runDir", default=os.path.join(here, "runs"))
+    args = parser.parse_args()
+
+    if "WM_PROJECT_DIR" not in os.environ:
+        sys.exit("OpenFOAM environment not found")
+
+    if not os.path.isdir(args.runDir):
+        os.makedirs(args.runDir)
+
+    runs = []
+    for model in args.models:
+        for n in args.sizes:
+            caseName, caseDir = setupCase(n, model, args)
+            for mode in args.modes:
+                print("Running %s %s" % (caseName, mode))
+                sys.stdout.flush()
+                result = runMode(caseDir, mode, args)
+                result.update({
+                    "case": caseName, "model": model, "nCells": n**3
+                })
+                runs.append(result)
+
+    caseRatios = ratios(runs)
+
+    results = {
+        "meta": {
+            "host": socket.gethostname(),
+            "date": datetime.datetime.now().isoformat(),
+            "WM_OPTIONS": os.environ.get("WM_OPTIONS"),
+            "nProcs": args.np,
+            "iterations": args.iterations,
+            "primal": "passive",
+            "units": {"wallTime": "s", "peakRSS": "kB", "tapeMB": "MB"},
+        },
+        "runs": runs,
+        "ratios": caseRatios,
+    }
+
+    with open(args.output, "w") as f:
+        json.dump(results, f, indent=4, sort_keys=True)
+
+    printSummary(runs, caseRatios)
+    print("\nResults written to " + args.output)
+
+
+if __name__ == "__main__":
+    main()
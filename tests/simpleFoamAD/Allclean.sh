@@ -7,4 +7,6 @@ fi
 
 cd simpleFoamMVStateProductReverse && wclean && rm log && cd - || exit 1
 cd simpleFoamMVPointProductReverse && wclean && rm log && cd - || exit 1
+cd simpleFoamMVProductTapedReverse && wclean && rm log && cd - || exit 1
 cd run && rm *.txt && cd - || exit 1
+cd run && rm -f dRdW_FAD_proc* && cd - || exit 1
@@ -7,8 +7,10 @@ fi
 
 cd simpleFoamMVStateProductReverse && wclean && wmake 2> log && cd - || exit 1
 cd simpleFoamMVPointProductReverse && wclean && wmake 2> log && cd - || exit 1
+cd simpleFoamMVProductTapedReverse && wclean && wmake 2> log && cd - || exit 1
 cd run && cp refs/* . && cd - || exit 1
 cd run && mpirun -np 4 simpleFoamMVStateProductReverse -parallel && cd - || exit 1
 cd run && mpirun -np 4 simpleFoamMVPointProductReverse -parallel && cd - || exit 1
 cd run && python checkDerivs.py 4 state && cd - || exit 1
 cd run && python checkDerivs.py 4 point && cd - || exit 1
+cd run && mpirun -np 4 simpleFoamMVProductTapedReverse -parallel && cd - || exit 1
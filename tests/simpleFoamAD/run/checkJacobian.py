@@ -0,0 +1,102 @@
+"""
+Compare columns of the coloured forward mode dRdW (simpleFoamStateJacobianForward)
+with the columns computed one at a time by simpleFoamStatePartDerivForward
+"""
+
+import numpy as np
+from numpy import linalg as LA
+import sys
+
+nProcs = int(sys.argv[1])
+tol = 1.0e-8
+
+# U and p rows/columns are cells with components (Ux, Uy, Uz, p)
+nCmpts = 4
+
+# read the triplets of all processors. The local rows of each processor are
+# consecutive, which gives the cell offset and the number of cells
+jac = {}
+offsets = []
+nCells = []
+for n in range(nProcs):
+
+    print("Processing %d" % n)
+
+    f = open("dRdW_FAD_proc%d" % n, "r")
+    lines = f.readlines()
+    f.close()
+
+    rowMin = -1
+    rowMax = -1
+    for line in lines[1:]:
+        cols = line.split()
+        row = int(cols[0])
+        col = int(cols[1])
+        jac[(row, col)] = float(cols[2])
+        if rowMin < 0 or row < rowMin:
+            rowMin = row
+        if row > rowMax:
+            rowMax = row
+
+    offsets.append(rowMin // nCmpts)
+    nCells.append(rowMax // nCmpts - rowMin // nCmpts + 1)
+
+f = open("dRdWColumns.txt", "r")
+columns = f.readlines()
+f.close()
+
+failed = False
+
+for column in columns:
+
+    var, comp, cellI, procI = column.split()
+    comp = int(comp)
+    cellI = int(cellI)
+    procI = int(procI)
+
+    if var == "U":
+        colCmpt = comp
+    elif var == "p":
+        colCmpt = 3
+    globalCol = (offsets[procI] + cellI) * nCmpts + colCmpt
+
+    refList = []
+    jacList = []
+    for n in range(nProcs):
+
+        f = open("dRdW_%s%d_Idx_%d_ProcI%d_FAD.txt" % (var, comp, cellI, n), "r")
+        lines = f.readlines()
+        f.close()
+
+        # U rows first, then p rows, the phi rows are not in the Jacobian
+        for localI in range(nCells[n]):
+            for cmpt in range(nCmpts):
+                if cmpt < 3:
+                    refList.append(float(lines[localI * 3 + cmpt]))
+                else:
+                    refList.append(float(lines[3 * nCells[n] + localI]))
+                globalRow = (offsets[n] + localI) * nCmpts + cmpt
+                jacList.append(jac.get((globalRow, globalCol), 0.0))
+
+    refList = np.asarray(refList)
+    jacList = np.asarray(jacList)
+
+    diff = jacList - refList
+    relErr = LA.norm(diff) / LA.norm(refList)
+
+    print("Column %s%d cell %d proc %d" % (var, comp, cellI, procI))
+    print("Max diff in dRdW column: ", abs(diff).max())
+    print("Relative diff norm in dRdW column: ", relErr)
+
+    if relErr > tol:
+        failed = True
+
+if failed:
+    print("\n**********************************************")
+    print("Test Failed!!!!!! Relative error > %g" % tol)
+    print("**********************************************")
+    exit(1)
+else:
+    print("\n**********************************************")
+    print("Test Passed!")
+    print("**********************************************")
@@ -0,0 +1,14 @@
+#!/usr/bin/env bash
+
+# Needs the forward mode (CODI_AD_FORWARD) build of simpleFoamStateJacobianForward
+# and simpleFoamStatePartDerivForward
+
+cp refs/dRdWColumns.txt . || exit 1
+
+mpirun -np 4 simpleFoamStateJacobianForward -parallel || exit 1
+
+while read var comp cell proc; do
+  mpirun -np 4 simpleFoamStatePartDerivForward -parallel -var $var -comp $comp -cell $cell -proc $proc < /dev/null || exit 1
+done < dRdWColumns.txt
+
+python checkJacobian.py 4 || exit 1